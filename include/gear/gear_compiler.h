@@ -501,6 +501,10 @@ GEAR_API void gearc_compile(gear_compiler *compiler);
  *  The code must be compiled with #gearc_compile before this function is called.
  *  Once a compiler has been released it should not be used again.
  *
+ *  Stores into a nursery-sized object allocated with no intervening call, allocation, or other safepoint are emitted without write barriers,
+ *  and stores of null or primitive values are emitted without the generational barrier.
+ *  See #GEAR_NO_BARRIER_ELISION for the exact conditions and how to disable this.
+ *
  *  \param[in] compiler An instance of the Gear compiler.
  *  \param[in] target The kind of target to generate (e.g. executable, library, etc...).
  *  \param[in] outfile The name of the file to write the compiled module to.
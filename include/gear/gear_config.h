@@ -15,6 +15,9 @@
    If it's not available on your platform, then it must be created manually or downloaded. */
 #include <stdint.h>
 
+/* The "stddef.h" header defines the size_t type used by the API for byte counts. */
+#include <stddef.h>
+
 /*! \brief This preprocessor directive must be defined when building Gear as a dynamic link library (.DLL) on Windows.
  *
  *  This preprocessor directive is defined by default when building Gear using its build scripts. 
@@ -35,7 +38,7 @@
  *  \note
  *  Gear adheres to semantic versioning.
  */
-#define GEAR_VERSION_STRING "0.7.1 (pre-alpha)"
+#define GEAR_VERSION_STRING "0.8.0 (pre-alpha)"
 
 /*! \brief The major version of Gear.
  *
@@ -47,13 +50,13 @@
  *
  *  The minor version of Gear as an integer.
  */
-#define GEAR_VERSION_MINOR 7
+#define GEAR_VERSION_MINOR 8
 
 /*! \brief The patch version of Gear.
  *
  *  The patch version of Gear as an integer.
  */
-#define GEAR_VERSION_PATCH 1
+#define GEAR_VERSION_PATCH 0
 
 /*! \brief Defines the Unicode character storage type used by Gear.
  *
@@ -67,6 +70,10 @@
  *  By default, this type aliases `uint_least32_t` making it identical with C11 and C++20's `char32_t` type.
  *  This allows UTF-32 encoded string literals `U"..."` and character literals `U' '` to be
  *  assigned to and from this type.
+ *
+ *  This type only describes individual characters.
+ *  Strings are stored as arrays of this type only when they have been widened or when Gear is built with
+ *  #GEAR_NO_COMPACT_STRINGS, otherwise they are stored more compactly.
  */
 typedef uint_least32_t gear_char;
 #define GEAR_FORMAT_CHAR "%04X"
@@ -84,6 +91,7 @@ typedef uint_least32_t gear_char;
  *  GEAR_INT_LONGLONG       | long long
  *
  *  The header can be modified to use any integer type, but it's must be a \e signed integer type.
+ *  The `GEAR_FORMAT_INT` and `GEAR_STRING_TO_INT` macros are only used for conversions when #GEAR_LIBC_NUMBERS is defined.
  */
 #ifdef DOXYGEN
 typedef storage_type gear_int;
@@ -123,6 +131,7 @@ typedef storage_type gear_int;
  *  GEAR_FLOAT_LONGDOUBLE   | long double
  *
  *  The header can be modified to use any floating point type, but it's must be a \e signed type.
+ *  The `GEAR_FORMAT_REAL` and `GEAR_STRING_TO_REAL` macros are only used for conversions when #GEAR_LIBC_NUMBERS is defined.
  */
 #ifdef DOXYGEN
 typedef storage_type gear_float;
@@ -133,17 +142,443 @@ typedef storage_type gear_float;
 #if defined(GEAR_FLOAT_FLOAT)
     typedef float gear_float;
     #define GEAR_FORMAT_REAL "%.7g"
+    #define GEAR_STRING_TO_REAL(s,p) strtof((s), (p))
     #define GEAR_FLOAT_SUFFIX(F) F##f
 #elif defined(GEAR_FLOAT_DOUBLE)
     typedef double gear_float;
     #define GEAR_FORMAT_REAL "%.14g"
+    #define GEAR_STRING_TO_REAL(s,p) strtod((s), (p))
     #define GEAR_FLOAT_SUFFIX(F) F
 #elif defined(GEAR_FLOAT_LONGDOUBLE)
     typedef long double gear_float;
     #define GEAR_FORMAT_REAL "%.19Lg"
+    #define GEAR_STRING_TO_REAL(s,p) strtold((s), (p))
     #define GEAR_FLOAT_SUFFIX(F) F##L
 #else
     #error "Numeric float type not defined"
 #endif
 
+/*! \brief Disables the generational garbage collector.
+ *
+ *  By default, the Gear garbage collector is generational.
+ *  New objects are allocated in a young generation (the \e nursery) by bumping a pointer within a chunk
+ *  that is local to the runtime, which makes allocation nearly free.
+ *  The nursery is collected by a copying minor collection and objects that survive are promoted to the old generation.
+ *  References from the old generation to the young generation are tracked by a write barrier in a remembered set.
+ *
+ *  Since most objects die young, minor collections only trace a small fraction of the heap.
+ *  Define this directive to allocate every object directly in the old generation instead.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_GENERATIONAL_GC
+#endif
+
+/*! \brief Defines the size, in bytes, of the young generation.
+ *
+ *  When the nursery fills up a minor collection is performed.
+ *  A larger nursery gives objects more time to die before they are traced, but it increases the length of each minor collection.
+ *  The size must be a multiple of #GEAR_GC_NURSERY_CHUNK_SIZE.
+ */
+#ifndef GEAR_GC_NURSERY_SIZE
+#define GEAR_GC_NURSERY_SIZE (4 * 1024 * 1024)
+#endif
+
+/*! \brief Defines the size, in bytes, of a nursery chunk.
+ *
+ *  The nursery is handed out to allocating threads in chunks of this size.
+ *  Allocation within a chunk is a pointer bump and only refilling a chunk requires synchronization.
+ */
+#ifndef GEAR_GC_NURSERY_CHUNK_SIZE
+#define GEAR_GC_NURSERY_CHUNK_SIZE (64 * 1024)
+#endif
+#if GEAR_GC_NURSERY_SIZE % GEAR_GC_NURSERY_CHUNK_SIZE != 0
+    #error "Nursery size must be a multiple of the nursery chunk size"
+#endif
+
+/*! \brief Defines the default number of garbage collector worker threads.
+ *
+ *  The mark phase is performed in parallel by a pool of worker threads.
+ *  Each worker has its own mark stack and idle workers steal work from the stacks of busy workers.
+ *  Every runtime owns its own workers, so the default is kept small to bound the number of threads
+ *  in processes that host many runtimes.
+ *  A value of zero creates one worker for each hardware thread, which is only advisable for processes with a single large runtime.
+ *  The worker count can be changed for an individual runtime with #gear_gc_set_workers.
+ */
+#ifndef GEAR_GC_WORKERS
+#define GEAR_GC_WORKERS 2
+#endif
+#if GEAR_GC_WORKERS < 0
+    #error "Garbage collector worker count must not be negative"
+#endif
+
+/*! \brief Defines how the garbage collector sweeps unreachable objects.
+ *
+ *  Define one of the following preprocessor definitions to choose when dead objects are reclaimed.
+ *  By default, pages are swept concurrently by a background thread so collection pauses only
+ *  cover root scanning and the final remark, and their length does not grow with the size of the heap.
+ *
+ *  Preprocessor Definition  | Sweeping Strategy
+ *  ------------------------ | -----------------
+ *  GEAR_GC_SWEEP_EAGER      | Pages are swept during the collection pause
+ *  GEAR_GC_SWEEP_LAZY       | Pages are swept by the allocator when it needs a free slot
+ *  GEAR_GC_SWEEP_CONCURRENT | Pages are swept by a background thread and lazily by the allocator if it gets ahead
+ *
+ *  Platforms without threads should use lazy sweeping.
+ */
+#if !defined(GEAR_GC_SWEEP_EAGER) && !defined(GEAR_GC_SWEEP_LAZY) && !defined(GEAR_GC_SWEEP_CONCURRENT)
+#define GEAR_GC_SWEEP_CONCURRENT /* The default configuration. */
+#endif
+#if (defined(GEAR_GC_SWEEP_EAGER) + defined(GEAR_GC_SWEEP_LAZY) + defined(GEAR_GC_SWEEP_CONCURRENT)) != 1
+    #error "Exactly one garbage collector sweeping strategy must be defined"
+#endif
+
+/*! \brief Defines the size, in bytes, of a garbage collected heap page.
+ *
+ *  The old generation is divided into pages of this size.
+ *  It must be a power of two so the page of an object can be found by masking its address.
+ */
+#ifndef GEAR_GC_PAGE_SIZE
+#define GEAR_GC_PAGE_SIZE (32 * 1024)
+#endif
+#if (GEAR_GC_PAGE_SIZE & (GEAR_GC_PAGE_SIZE - 1)) != 0
+    #error "Heap page size must be a power of two"
+#endif
+
+/*! \brief Defines the size, in bytes, of the largest small object.
+ *
+ *  Objects up to this size are allocated by the small object allocator, which segregates them into size classes.
+ *  Each page holds objects of a single size class, keeps its free slots in a free list, and records which
+ *  slots are live in a mark bitmap stored apart from the objects.
+ *  This avoids per-object allocation headers, keeps objects of the same size close together, and limits fragmentation.
+ *
+ *  The default is a quarter of #GEAR_GC_PAGE_SIZE, so every size class fits at least four objects per page and
+ *  medium sized objects share pages instead of each wasting most of a page.
+ *  Larger objects are allocated individually in a run of contiguous pages.
+ */
+#ifndef GEAR_GC_SMALL_OBJECT_SIZE
+#define GEAR_GC_SMALL_OBJECT_SIZE (GEAR_GC_PAGE_SIZE / 4)
+#endif
+#if GEAR_GC_SMALL_OBJECT_SIZE > GEAR_GC_PAGE_SIZE
+    #error "Small object size must not exceed the heap page size"
+#endif
+
+/*! \brief Defines the number of size classes used by the small object allocator.
+ *
+ *  Size classes are spaced every 16 bytes up to 128 bytes and then four per doubling up to #GEAR_GC_SMALL_OBJECT_SIZE,
+ *  so rounding an object up to its size class wastes at most 15 bytes below 128 bytes and at most a fifth of the slot above it.
+ *  The default covers the default small object size; more classes are needed if the small object size is raised.
+ *  The occupancy of each class is reported by #gear_gc_get_stats.
+ */
+#ifndef GEAR_GC_SIZE_CLASS_COUNT
+#define GEAR_GC_SIZE_CLASS_COUNT 32
+#endif
+#if GEAR_GC_SIZE_CLASS_COUNT <= 0
+    #error "Size class count must be greater than zero"
+#endif
+
+/*! \brief Defines the default fragmentation threshold that triggers heap compaction.
+ *
+ *  When the percentage of free space in partially used pages of the old generation exceeds this threshold,
+ *  a full collection also compacts the heap.
+ *  The sparsest pages are evacuated by moving their live objects into other pages and updating every reference to them,
+ *  after which the evacuated pages are released.
+ *  A value of zero disables compaction.
+ *  The threshold can be changed for an individual runtime with #gear_gc_set_compaction.
+ */
+#ifndef GEAR_GC_COMPACT_THRESHOLD
+#define GEAR_GC_COMPACT_THRESHOLD 50
+#endif
+#if GEAR_GC_COMPACT_THRESHOLD < 0 || GEAR_GC_COMPACT_THRESHOLD > 100
+    #error "Compaction threshold must be a percentage between 0 and 100"
+#endif
+
+/*! \brief Disables write barrier elision in the Gear compiler.
+ *
+ *  The garbage collector uses two write barriers on stores of references into objects:
+ *
+ *   - A \e generational barrier records stores of young references into old objects in the remembered set.
+ *   - A \e marking barrier, active only while the heap is being marked concurrently, is a snapshot-at-the-beginning
+ *     deletion barrier: it marks the reference being overwritten so that no object reachable when marking began is lost.
+ *
+ *  By default, #gearc_build emits a barrier-free store instruction only when it can prove neither barrier is needed,
+ *  which is the case for stores into an object that is provably in the nursery and whose field still holds null:
+ *
+ *   - Stores into an object allocated earlier in the same basic block with no intervening call, allocation, or other safepoint.
+ *   - Initializing stores to the fields of an object within its constructor, under the same condition:
+ *     no call, allocation, or other safepoint may occur between allocating the object and the store.
+ *
+ *  In both cases the object's size must be known at compile time and be no larger than #GEAR_GC_NURSERY_CHUNK_SIZE,
+ *  since larger objects are allocated directly in the old generation.
+ *  For instance, the store in `var a = new Array(100000); a[0] = x;` keeps its barriers.
+ *  Without a safepoint in between the object cannot have been promoted, so the generational barrier is unnecessary.
+ *  The marking barrier is unnecessary because the overwritten field still holds null, so no reference is lost,
+ *  even if marking was already running when the object was allocated.
+ *  A store such as `this.items = new List()` allocates before it stores and therefore keeps its barriers.
+ *
+ *  Objects allocated while an allocation region is active are placed in the region's arena rather than the nursery.
+ *  Since this is only known at run time, the virtual machine executes barrier-free stores with both barriers while
+ *  a region begun with #gear_region_begin is active.
+ *  When Gear is built with #GEAR_NO_GENERATIONAL_GC there is no nursery and no generational barrier, and barrier-free stores
+ *  remain safe because the field being overwritten still holds null.
+ *
+ *  Stores of null or primitive values into other objects skip the generational barrier, since they cannot create an
+ *  old-to-young reference, but still perform the marking barrier, since they may overwrite the last reference to an object.
+ *
+ *  Define this directive to emit a write barrier for every reference store.
+ *  This is mostly useful for diagnosing garbage collector bugs.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_BARRIER_ELISION
+#endif
+
+/*! \brief Enables compressed object references.
+ *
+ *  When defined, each runtime reserves a contiguous 4 GB range of virtual memory for its heap and stores references
+ *  between objects as 32-bit offsets from the start of that range instead of as native pointers.
+ *  On 64-bit platforms this halves the size of every reference, which shrinks reference-heavy heaps and improves cache usage.
+ *
+ *  The heap of each runtime is limited to 4 GB and larger heap limits are clamped.
+ *  Since the range must be reserved from the operating system, a custom #gear_allocator is only used for memory outside the heap.
+ *  Compressed references are disabled by default and have no effect on 32-bit platforms.
+ */
+#ifdef DOXYGEN
+#define GEAR_COMPRESSED_POINTERS
+#endif
+
+/*! \brief Defines the size, in bytes, of the virtual address range reserved for each heap.
+ *
+ *  Each runtime reserves its heap as one contiguous range of virtual memory and commits it in chunks of
+ *  #GEAR_HEAP_COMMIT_SIZE as the heap grows.
+ *  Reserving address space does not consume physical memory.
+ *  Keeping the heap contiguous lets the garbage collector find the page of an object with simple arithmetic.
+ *
+ *  By default, 4 GB is reserved on 64-bit platforms and 1 GB on 32-bit platforms.
+ *  This keeps processes hosting thousands of runtimes well within the available address space.
+ *  When #GEAR_COMPRESSED_POINTERS is defined on a 64-bit platform, the reservation cannot exceed 4 GB.
+ *  The size must be a multiple of #GEAR_HEAP_COMMIT_SIZE.
+ *  If the runtime has a heap limit smaller than this size, then only the heap limit is reserved.
+ *
+ *  The reservation is not a limit on the size of the heap.
+ *  Once it is used up, and whenever the operating system refuses it, for instance, because of `RLIMIT_AS`,
+ *  the heap is committed in separate #GEAR_HEAP_COMMIT_SIZE aligned chunks outside of the range instead.
+ *  Only compressed pointers require the range, so with #GEAR_COMPRESSED_POINTERS a refused reservation makes
+ *  runtime creation fail and NULL is returned.
+ *  Runtimes created with a custom #gear_allocator request each chunk from the allocator instead, unless pointers are compressed.
+ *  Those chunks are aligned to their size but not contiguous, so the page of an object is still found by masking its address.
+ */
+#ifndef GEAR_HEAP_RESERVE_SIZE
+    #if UINTPTR_MAX <= 0xFFFFFFFFu
+        #define GEAR_HEAP_RESERVE_SIZE (1ULL * 1024 * 1024 * 1024)
+    #elif defined(GEAR_COMPRESSED_POINTERS)
+        #define GEAR_HEAP_RESERVE_SIZE (4ULL * 1024 * 1024 * 1024)
+    #else
+        #define GEAR_HEAP_RESERVE_SIZE (4ULL * 1024 * 1024 * 1024)
+    #endif
+#endif
+
+/*! \brief Defines the size, in bytes, of the chunks in which the heap is committed.
+ *
+ *  Memory is committed and returned to the operating system in chunks of this size.
+ *  It must be a multiple of #GEAR_GC_PAGE_SIZE.
+ *  The default matches the size of a transparent huge page on x86-64 Linux.
+ */
+#ifndef GEAR_HEAP_COMMIT_SIZE
+#define GEAR_HEAP_COMMIT_SIZE (2 * 1024 * 1024)
+#endif
+#if GEAR_HEAP_COMMIT_SIZE % GEAR_GC_PAGE_SIZE != 0
+    #error "Heap commit size must be a multiple of the heap page size"
+#endif
+#if GEAR_HEAP_RESERVE_SIZE % GEAR_HEAP_COMMIT_SIZE != 0
+    #error "Heap reserve size must be a multiple of the heap commit size"
+#endif
+#if defined(GEAR_COMPRESSED_POINTERS) && UINTPTR_MAX > 0xFFFFFFFFu && GEAR_HEAP_RESERVE_SIZE > (4ULL * 1024 * 1024 * 1024)
+    #error "Heap reserve size must not exceed 4 GB when pointers are compressed"
+#endif
+
+/*! \brief Disables huge pages for the heap.
+ *
+ *  On Linux, the reserved heap range is advised with `madvise(MADV_HUGEPAGE)` so the kernel can back it with transparent huge pages.
+ *  This reduces TLB misses when the garbage collector walks large heaps.
+ *  Define this directive to use regular pages instead, for instance, on systems where huge pages cause memory bloat.
+ *  This directive has no effect on other platforms.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_HUGE_PAGES
+#endif
+
+/*! \brief Disables compact string storage.
+ *
+ *  By default, strings whose characters are all within U+00FF are stored as Latin-1 with one byte per character.
+ *  Other strings are stored as UTF-8 and are only widened to one #gear_char per character when they are indexed
+ *  more often than their length would justify.
+ *  Indexing UTF-8 strings remains amortized constant time because the byte offset of every
+ *  #GEAR_STRING_BREADCRUMB_INTERVAL characters is cached the first time the string is indexed.
+ *
+ *  Define this directive to store every string with one #gear_char per character.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_COMPACT_STRINGS
+#endif
+
+/*! \brief Defines the number of characters between cached offsets in UTF-8 strings.
+ *
+ *  Indexing a character scans forward at most this many characters from the nearest cached offset.
+ *  Smaller intervals make indexing faster at the cost of more memory per indexed string.
+ */
+#ifndef GEAR_STRING_BREADCRUMB_INTERVAL
+#define GEAR_STRING_BREADCRUMB_INTERVAL 64
+#endif
+
+/*! \brief Defines the length, in bytes, at which string concatenation produces a rope.
+ *
+ *  Concatenating strings whose combined length is at least this size does not copy them.
+ *  Instead, the result is a \e rope that references both operands and is flattened into a contiguous string
+ *  the first time it is indexed or passed to the host with #gear_get_string.
+ *  Shorter results are copied since copying them is cheaper than allocating a rope.
+ *
+ *  The last leaf of a rope is a buffer with spare capacity that grows geometrically up to #GEAR_ROPE_LEAF_SIZE.
+ *  A right operand shorter than this threshold is copied into that spare capacity instead of adding a node,
+ *  as long as no other rope has already appended to the same leaf, in which case the leaf is copied first.
+ *  Only when the leaf is full is a new leaf started.
+ *  Together with incremental rebalancing, see #GEAR_ROPE_MAX_DEPTH, this makes building a string of \e n bytes
+ *  with repeated concatenation, such as `s = s + piece`, take amortized linear time instead of quadratic.
+ */
+#ifndef GEAR_ROPE_THRESHOLD
+#define GEAR_ROPE_THRESHOLD 256
+#endif
+
+/*! \brief Defines the maximum size, in bytes, of a rope leaf.
+ *
+ *  Leaves that short right operands are appended to grow until they reach this size.
+ *  Larger leaves mean fewer rope nodes per byte, but more memory is copied when a shared leaf must be copied.
+ */
+#ifndef GEAR_ROPE_LEAF_SIZE
+#define GEAR_ROPE_LEAF_SIZE (4 * 1024)
+#endif
+#if GEAR_ROPE_LEAF_SIZE < GEAR_ROPE_THRESHOLD
+    #error "Rope leaf size must be at least the rope threshold"
+#endif
+
+/*! \brief Defines the maximum depth of a rope.
+ *
+ *  Ropes are rebalanced incrementally to keep flattening and garbage collector tracing shallow.
+ *  When a concatenation would make a rope deeper than this, only the right spine of the rope is rebuilt by merging
+ *  adjacent subtrees of similar length, rather than rebuilding the whole rope.
+ *  Because each leaf holds up to #GEAR_ROPE_LEAF_SIZE bytes, this costs amortized logarithmic time per leaf.
+ */
+#ifndef GEAR_ROPE_MAX_DEPTH
+#define GEAR_ROPE_MAX_DEPTH 32
+#endif
+
+/*! \brief Defines the maximum length, in bytes, of strings interned at run time.
+ *
+ *  Every string computes its hash the first time it is needed and caches it.
+ *  String literals are always interned when a program is loaded.
+ *  Strings used as map keys or compared by a \c match statement are interned as well if they are no longer than this,
+ *  so comparing two interned strings only compares their addresses.
+ *  The intern table holds its strings weakly, so interned strings that are no longer used are garbage collected.
+ *  A value of zero disables interning at run time.
+ */
+#ifndef GEAR_INTERN_MAX_LENGTH
+#define GEAR_INTERN_MAX_LENGTH 64
+#endif
+
+/*! \brief Disables SIMD string processing.
+ *
+ *  By default, the runtime validates and transcodes UTF-8 with SIMD instructions, for instance, when strings cross the
+ *  API boundary with #gear_set_string and #gear_get_string or are encoded and decoded by the standard library.
+ *  The standard library's string routines, such as \c find, \c contains, \c split, \c replace, \c trim, \c startsWith,
+ *  \c endsWith, and \c count, also scan their input many bytes at a time.
+ *  Single character searches compare a full vector of bytes per step and substring searches use SIMD to locate candidate
+ *  matches by their first and last bytes before falling back to the Two-Way algorithm for long needles.
+ *  The instruction set is selected when the runtime starts based on what the processor supports (SSE4.2 or AVX2 on x86, NEON on ARM)
+ *  and portable scalar code is used on other processors.
+ *
+ *  Define this directive to always use the scalar code, for instance, when the compiler does not support the intrinsics.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_SIMD
+#endif
+
+/*! \brief Disables the small string optimization.
+ *
+ *  By default, strings that are short enough to fit inside a value, alongside its type tag, are stored inline
+ *  instead of being allocated on the heap.
+ *  Short strings, like identifiers and codes, then cost no allocation and are skipped by the garbage collector.
+ *  How many bytes fit depends on the size of a value, which is determined by the #gear_int and #gear_float storage types.
+ *  Strings are treated as value types by \c WeakRef and \c WeakMap, see #gear_set_weak.
+ *
+ *  Define this directive to allocate every string on the heap.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_SMALL_STRINGS
+#endif
+
+/*! \brief Uses the C standard library to convert numbers to and from strings.
+ *
+ *  By default, the runtime converts numbers with its own routines, which do not depend on the C locale.
+ *  Floats are formatted with the shortest representation that parses back to the same value and are parsed
+ *  with correct rounding, while integers are formatted and parsed without calling into the C standard library.
+ *  This applies to all conversions, including #gear_get_string on a number.
+ *
+ *  Define this directive to use `snprintf` with `GEAR_FORMAT_INT` and `GEAR_FORMAT_REAL`, `GEAR_STRING_TO_REAL`, and `GEAR_STRING_TO_INT` instead.
+ *  Float formatting then uses a fixed precision and all conversions follow the current C locale.
+ *
+ *  \note
+ *  Built-in conversions are the default as of version 0.8.0, which changes how floats are formatted by existing programs and hosts.
+ *  Floats are no longer formatted with `GEAR_FORMAT_REAL`'s fixed number of significant digits, so their text can differ.
+ *  Define this directive to keep the previous output.
+ */
+#ifdef DOXYGEN
+#define GEAR_LIBC_NUMBERS
+#endif
+
+/*! \brief Defines the initial capacity, in bytes, of a \c StringBuilder.
+ *
+ *  The standard library's \c StringBuilder type appends to a mutable buffer that doubles in size when it is full,
+ *  so building a string of \e n bytes takes amortized linear time.
+ *  Numbers are formatted directly into the buffer without creating intermediate strings.
+ *  Converting the builder to a \c String hands its buffer over to the string without copying it, provided the
+ *  unused capacity is no more than a quarter of the string's length.
+ *  Otherwise, the contents are copied into an exactly sized string, which costs at most one extra copy and is amortized
+ *  against the appends that built it.
+ *  Either way, a string never keeps more than a quarter of its length as slack.
+ *
+ *  The builder is left empty and without a buffer, so appending to it again starts over with a new buffer of this capacity
+ *  and never affects the string.
+ */
+#ifndef GEAR_STRING_BUILDER_CAPACITY
+#define GEAR_STRING_BUILDER_CAPACITY 64
+#endif
+
+/*! \brief Defines the length, in bytes, at which substrings and sub-arrays become views.
+ *
+ *  Slicing a string or array to at least this many bytes returns a view that shares the storage of the original in constant time.
+ *  Shorter slices are copied because a copy is cheaper than a view and does not keep the original alive.
+ *  Arrays are copied on write, so modifying a view or the array it was taken from never affects the other.
+ *  Calling \c copy() on a view always produces an independent copy.
+ *  String views are not null terminated, so #gear_get_string copies them before returning them to the host.
+ *
+ *  A view keeps the storage of the original reachable.
+ *  When a full collection finds storage that is only reachable through views covering a small part of it,
+ *  the views are copied so the storage can be released.
+ */
+#ifndef GEAR_SLICE_VIEW_THRESHOLD
+#define GEAR_SLICE_VIEW_THRESHOLD 32
+#endif
+
+/*! \brief Excludes Unicode normalization from the runtime.
+ *
+ *  Character classification, case mapping, and normalization look up Unicode properties in compact multi-stage tables
+ *  that are generated from the Unicode Character Database when Gear is built.
+ *  ASCII characters are handled by a fast path that does not consult the tables.
+ *
+ *  The normalization (NFC and NFD) tables are the largest of these.
+ *  Define this directive to leave them out of the runtime when size matters more than normalization support,
+ *  in which case the standard library's normalization functions raise an error.
+ */
+#ifdef DOXYGEN
+#define GEAR_NO_UNICODE_NORMALIZATION
+#endif
+
 #endif
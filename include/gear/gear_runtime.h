@@ -17,6 +17,8 @@
  *
  *  \sa gear_new_from_file
  *  \sa gear_new_from_memory
+ *  \sa gear_new_from_file_with_allocator
+ *  \sa gear_new_from_memory_with_allocator
  *  \sa gear_delete
  */
 typedef struct gear_runtime gear_runtime;
@@ -32,10 +34,25 @@ typedef struct gear_runtime gear_runtime;
  *  For instance, register assignment should be performed using #gear_move of C's assignment operator.
  *
  *  While a value is referenced by a register, it cannot be garbage collected.
+ *  The garbage collector may move the value in memory, but the register will continue to reference it.
  *  There is no limit on the number of virtual registers that can be created.
  */
 typedef long gear_register;
 
+/*! \brief A handle to a field of a Gear object.
+ *
+ *  Objects of the same type share a \e shape that maps each field to a fixed slot in the object.
+ *  A field handle caches that mapping so the field can be read and written without looking up its name.
+ *  Handles should be resolved once with #gear_get_field_handle and reused.
+ *
+ *  This type should be treated as an *abstract handle*.
+ *  Its underlying integer value is not safe to inspect or modify.
+ *
+ *  \sa gear_get_field
+ *  \sa gear_set_field
+ */
+typedef long gear_field;
+
 /*! \brief The function prototype of a C function that's exposed to Gear.
  *
  *  Natively wrapped C functions should conform to this function signature.
@@ -55,6 +72,148 @@ typedef int(*gear_C_function)(gear_runtime *runtime, int argc);
  */
 typedef int(*gear_C_error)(const char *error_message);
 
+/*! \brief The capacity of the per size class statistics in #gear_gc_stats.
+ *
+ *  This is fixed, rather than derived from #GEAR_GC_SIZE_CLASS_COUNT, so that changing the number of size classes
+ *  does not change the layout of #gear_gc_stats.
+ */
+#define GEAR_GC_STATS_SIZE_CLASSES 64
+#if GEAR_GC_SIZE_CLASS_COUNT > GEAR_GC_STATS_SIZE_CLASSES
+    #error "Size class count must not exceed GEAR_GC_STATS_SIZE_CLASSES"
+#endif
+
+/*! \brief Garbage collector and heap statistics for a Gear runtime.
+ *
+ *  Statistics are retrieved with #gear_gc_get_stats and passed to the callback registered with #gear_gc_set_callback.
+ *  Byte counts include only memory managed by the garbage collector.
+ *  Times are measured in microseconds.
+ *
+ *  New fields are only ever added to the end of this structure.
+ *  The leading \c size field records how much of the structure is valid, so hosts compiled against an older or newer
+ *  version of this header keep working: fields that lie beyond \c size must not be read.
+ *
+ *  \sa gear_gc_get_stats
+ */
+typedef struct gear_gc_stats gear_gc_stats;
+
+struct gear_gc_stats
+{
+    /*! \brief The size of this structure in bytes.
+     *
+     *  Set by the host to `sizeof(gear_gc_stats)` before calling #gear_gc_get_stats.
+     *  The runtime stores the number of bytes it actually filled in.
+     */
+    size_t size;
+
+    /*! \brief The number of bytes of the heap that are committed, as opposed to merely reserved. */
+    size_t heap_size;
+
+    /*! \brief The number of bytes that were reachable at the end of the last collection. */
+    size_t live_bytes;
+
+    /*! \brief The total number of bytes allocated since the runtime was created. */
+    uint64_t allocated_bytes;
+
+    /*! \brief The number of bytes allocated per second, averaged since the previous collection. */
+    double allocation_rate;
+
+    /*! \brief The number of minor collections, which only collect the young generation. */
+    uint64_t minor_collections;
+
+    /*! \brief The number of full collections, which collect the entire heap. */
+    uint64_t full_collections;
+
+    /*! \brief The number of full collections that also compacted the heap. */
+    uint64_t compactions;
+
+    /*! \brief The total time the program has been paused by the garbage collector. */
+    uint64_t pause_total;
+
+    /*! \brief The longest time the program has been paused by the garbage collector. */
+    uint64_t pause_max;
+
+    /*! \brief The number of bytes occupied by live objects larger than #GEAR_GC_SMALL_OBJECT_SIZE at the end of the last collection. */
+    size_t large_object_bytes;
+
+    /*! \brief The number of entries of \c size_class_bytes that are valid, which is #GEAR_GC_SIZE_CLASS_COUNT. */
+    int size_class_count;
+
+    /*! \brief The number of bytes occupied by live objects of each size class at the end of the last collection. */
+    size_t size_class_bytes[GEAR_GC_STATS_SIZE_CLASSES];
+};
+
+/*! \brief The signature of a C function invoked at the end of each garbage collection.
+ *
+ *  The callback is invoked on the thread that is executing the runtime, at the first safepoint after the collection ends.
+ *  It is never invoked on a garbage collector worker thread or the background sweeper.
+ *  The statistics are only valid for the duration of the call.
+ *  The \c size field of the statistics should be checked before reading fields the runtime may not provide.
+ *  The callback must not call back into the runtime, except for #gear_gc_get_stats.
+ */
+typedef void(*gear_C_gc)(gear_runtime *runtime, const gear_gc_stats *stats);
+
+/*! \brief A custom memory allocator for a Gear runtime.
+ *
+ *  All memory used by a runtime created with #gear_new_from_file_with_allocator or #gear_new_from_memory_with_allocator,
+ *  including the heap and the runtime's internal bookkeeping, is requested through these functions.
+ *  The sizes of blocks are passed back when they are resized or released so allocators do not need to track them.
+ *  When Gear is built with #GEAR_COMPRESSED_POINTERS, the heap is reserved from the operating system instead.
+ *
+ *  Every request carries the alignment the block must have, which is always a power of two.
+ *  The heap is requested in chunks of #GEAR_HEAP_COMMIT_SIZE bytes aligned to #GEAR_HEAP_COMMIT_SIZE,
+ *  which lets the garbage collector find the page of an object by masking its address even though the chunks
+ *  are not contiguous.
+ *  Objects that do not fit in one chunk are requested as a single block whose size is rounded up to a multiple of
+ *  #GEAR_HEAP_COMMIT_SIZE and which is also aligned to #GEAR_HEAP_COMMIT_SIZE.
+ *  Other blocks are requested with the alignment of the largest fundamental type.
+ *  An allocator that cannot satisfy an alignment must fail the request by returning NULL.
+ *
+ *  The functions may be called from garbage collector threads, so they must be thread-safe.
+ *  The user data must remain valid until the runtime is released with #gear_delete.
+ */
+typedef struct gear_allocator gear_allocator;
+
+struct gear_allocator
+{
+    /*! \brief Allocates a block of memory of the given size and alignment or returns NULL on failure. */
+    void *(*allocate)(void *user_data, size_t size, size_t alignment);
+
+    /*! \brief Resizes a block of memory, preserving its alignment, or returns NULL on failure, in which case the original block is left untouched. */
+    void *(*reallocate)(void *user_data, void *block, size_t old_size, size_t new_size, size_t alignment);
+
+    /*! \brief Releases a block of memory previously returned by the allocator. */
+    void (*deallocate)(void *user_data, void *block, size_t size);
+
+    /*! \brief A user defined pointer passed to each function. */
+    void *user_data;
+};
+
+/*! \brief Defines how references that escape an allocation region are handled.
+ *
+ *  A reference escapes a region when an object allocated inside the region is still referenced
+ *  from outside of it, such as from a register, a global variable, or an object allocated before the region began.
+ *
+ *  \sa gear_region_begin
+ *  \sa gear_region_end
+ */
+enum gear_region_policy
+{
+    /*! \brief Escaping objects are promoted to the garbage collected heap.
+     *
+     *  Objects reachable through an escaping reference are moved out of the region before it is released.
+     *  Promotion is always safe, but the cost grows with the number of escaping objects.
+     */
+    GEAR_REGION_PROMOTE,
+
+    /*! \brief Escaping references are reported as an error.
+     *
+     *  Escaping references are cleared to null and an error is reported when the region ends.
+     *  This is useful for verifying that per-request code does not leak objects.
+     */
+    GEAR_REGION_ERROR,
+};
+typedef enum gear_region_policy gear_region_policy;
+
 /*! \brief Allocates a new #gear_runtime from a compiled Gear program file.
  *
  *  Opens the specified file as a Gear program and returns a new instance of a #gear_runtime.
@@ -85,13 +244,66 @@ GEAR_API gear_runtime *gear_new_from_file(const char *file_name);
  */
 GEAR_API gear_runtime *gear_new_from_memory(const unsigned char *buffer, int buffer_size);
 
+/*! \brief Allocates a new #gear_runtime from a compiled Gear program file using a custom allocator.
+ *
+ *  Behaves like #gear_new_from_file except all memory is requested from the given allocator
+ *  and the heap is limited to the given size.
+ *  This allows multiple runtimes in one process to be accounted for separately and to be backed by
+ *  allocator arenas or memory pools.
+ *
+ *  When an allocation would exceed the heap limit, the garbage collector performs a full collection.
+ *  If there is still not enough memory, then an out of memory error is raised in Gear code where it can be caught.
+ *  If it is not caught, then it is reported to the host like any other error.
+ *  An allocation that fails in the allocator itself is treated the same way.
+ *
+ *  The heap limit is never exceeded, even while collection is suspended with #gear_gc_suspend.
+ *  A suspension cap above the limit is lowered to it and a cap of zero means the limit.
+ *
+ *  The heap limit covers all memory managed by the garbage collector, including the nursery (#GEAR_GC_NURSERY_SIZE)
+ *  and the arenas of allocation regions begun with #gear_region_begin.
+ *  It must leave room for the nursery plus one #GEAR_HEAP_COMMIT_SIZE chunk, otherwise the runtime is not created
+ *  and NULL is returned.
+ *
+ *  \param[in] file_name The name of the compiled Gear program file.
+ *  \param[in] allocator The allocator to request memory from. The structure is copied.
+ *  \param[in] heap_limit The maximum size of the heap in bytes or zero for no limit.
+ *  \return A heap allocated #gear_runtime or NULL if the allocator failed to allocate it or the heap limit is too small.
+ *          The runtime must be released with #gear_delete.
+ *
+ *  \sa gear_new_from_memory_with_allocator
+ *  \sa gear_delete
+ *  \since 0.8.0
+ */
+GEAR_API gear_runtime *gear_new_from_file_with_allocator(const char *file_name, const gear_allocator *allocator, size_t heap_limit);
+
+/*! \brief Allocates a new #gear_runtime from memory using a custom allocator.
+ *
+ *  Behaves like #gear_new_from_memory except all memory is requested from the given allocator
+ *  and the heap is limited to the given size.
+ *  See #gear_new_from_file_with_allocator for what the heap limit covers and how it is enforced.
+ *
+ *  \param[in] buffer A byte buffer of a Gear program file.
+ *  \param[in] buffer_size The size of the buffer.
+ *  \param[in] allocator The allocator to request memory from. The structure is copied.
+ *  \param[in] heap_limit The maximum size of the heap in bytes or zero for no limit.
+ *  \return A heap allocated #gear_runtime or NULL if the allocator failed to allocate it or the heap limit is too small.
+ *          The runtime must be released with #gear_delete.
+ *
+ *  \sa gear_new_from_file_with_allocator
+ *  \sa gear_delete
+ *  \since 0.8.0
+ */
+GEAR_API gear_runtime *gear_new_from_memory_with_allocator(const unsigned char *buffer, int buffer_size, const gear_allocator *allocator, size_t heap_limit);
+
 /*! \brief Releases resources associated with a Gear runtime.
  *
  *  Once a runtime has been released it should not be used again.
  *  Any runtime resources, like allocated registers, will automatically be free'd.
+ *  Background threads owned by the garbage collector, such as the concurrent sweeper, are stopped before this function returns.
  *
  *  \param[in] runtime The Gear runtime to release.
- *                     The runtime should have been generated by #gear_new_from_file or #gear_new_from_memory.
+ *                     The runtime should have been generated by #gear_new_from_file, #gear_new_from_memory,
+ *                     #gear_new_from_file_with_allocator, or #gear_new_from_memory_with_allocator.
  *
  *  \since 0.1.0
  *  \sa gear_new_from_file
@@ -301,15 +513,36 @@ GEAR_API void gear_set_float(gear_runtime *runtime, gear_register r, gear_float
 GEAR_API void gear_set_bool(gear_runtime *runtime, gear_register r, int value);
 
 /*! \brief Sets the value of the register to a string.
+ *
+ *  The string is copied into the runtime using the most compact storage that can represent its characters.
+ *  Invalid UTF-8 sequences are replaced with the replacement character U+FFFD.
  *
  *  \param[in] runtime The Gear runtime.
  *  \param[in] reg The register to set.
- *  \param[in] value The integer value to store in the register.
+ *  \param[in] value The UTF-8 encoded string to store in the register.
  *
  *  \since 0.1.0
+ *  \sa gear_set_string_n
  */
 GEAR_API void gear_set_string(gear_runtime *runtime, gear_register r, const char *value);
 
+/*! \brief Sets the value of the register to a string of the given length.
+ *
+ *  Behaves like #gear_set_string except the length of the string is given rather than found by scanning for the null terminator.
+ *  This avoids a pass over large strings whose length is already known and allows strings to contain null characters.
+ *  Such strings can be read back intact with #gear_get_string_n.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] reg The register to set.
+ *  \param[in] value The UTF-8 encoded string to store in the register.
+ *  \param[in] length The length of the string in bytes.
+ *
+ *  \since 0.8.0
+ *  \sa gear_set_string
+ *  \sa gear_get_string_n
+ */
+GEAR_API void gear_set_string_n(gear_runtime *runtime, gear_register reg, const char *value, size_t length);
+
 /*! \brief Sets the value of the register to a C function.
  *
  *  A function can be passed to the runtime for invocation.
@@ -333,6 +566,99 @@ GEAR_API void gear_set_field_function(gear_runtime *runtime, gear_register regis
  */
 GEAR_API void gear_set_object(gear_runtime *runtime, gear_register reg, const char *symbol);
 
+/*! \brief Resolves a handle to a field of a type.
+ *
+ *  \code
+ *  gear_field x;
+ *  gear_get_field_handle(runtime, "Point", "x", &x); // Resolve the handle once.
+ *
+ *  gear_set_object(runtime, reg, "Point");
+ *  gear_set_int(runtime, value, 4);
+ *  gear_set_field(runtime, reg, x, value); // point.x = 4
+ *  \endcode
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] symbol The exported symbol name of the type.
+ *  \param[in] field_name The name of the field.
+ *  \param[out] field The resolved field handle.
+ *  \return A non-zero value is returned if the type or field could not be found.
+ *
+ *  \since 0.8.0
+ *  \sa gear_get_field
+ *  \sa gear_set_field
+ */
+GEAR_API int gear_get_field_handle(gear_runtime *runtime, const char *symbol, const char *field_name, gear_field *field);
+
+/*! \brief Reads a field of an object into a register.
+ *
+ *  The object does not need to be of the type the handle was resolved from.
+ *  Since typing is structural, any object with a field of the same name and type is accepted,
+ *  though objects of the original type are accessed fastest.
+ *  If the object does not have the field, then the destination is set to null and the error flag set.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] reg The register containing the object.
+ *  \param[in] field The field to read.
+ *  \param[in] dest The destination register.
+ *
+ *  \since 0.8.0
+ *  \sa gear_get_field_handle
+ */
+GEAR_API void gear_get_field(gear_runtime *runtime, gear_register reg, gear_field field, gear_register dest);
+
+/*! \brief Writes a register to a field of an object.
+ *
+ *  The object is matched against the field the same way as #gear_get_field.
+ *  If the object does not have the field or the value is of the wrong type, then the error flag is set.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] reg The register containing the object.
+ *  \param[in] field The field to write.
+ *  \param[in] src The register containing the new value.
+ *
+ *  \since 0.8.0
+ *  \sa gear_get_field_handle
+ */
+GEAR_API void gear_set_field(gear_runtime *runtime, gear_register reg, gear_field field, gear_register src);
+
+/*! \brief Creates a weak reference to a value and assigns it to the specified register.
+ *
+ *  A weak reference does not prevent its target from being garbage collected.
+ *  Once the target is collected, the weak reference is cleared.
+ *  The register holds an instance of the standard library's \c WeakRef type.
+ *
+ *  Weak references are useful for caches that should not keep objects alive.
+ *  For caches keyed by objects, the standard library's \c WeakMap type holds each value only as long as its key
+ *  is reachable from outside the map (an \e ephemeron table) and can be allocated with #gear_set_object.
+ *
+ *  If the target is a value type, then the weak reference is never cleared.
+ *  Strings are treated as value types for this purpose whether they are stored inline or on the heap,
+ *  so a weak reference to a string is never cleared and \c WeakMap raises an error when given a string key.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] reg The register to be assigned the weak reference.
+ *  \param[in] target The register containing the value to reference.
+ *
+ *  \since 0.8.0
+ *  \sa gear_get_weak
+ */
+GEAR_API void gear_set_weak(gear_runtime *runtime, gear_register reg, gear_register target);
+
+/*! \brief Retrieves the target of a weak reference.
+ *
+ *  If the target has been garbage collected, then the destination register is set to null.
+ *  Storing the target in a register keeps it alive until the register is overwritten.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] reg The register containing the weak reference.
+ *  \param[in] dest The destination register.
+ *  \return A non-zero value is returned if the target has been garbage collected.
+ *
+ *  \since 0.8.0
+ *  \sa gear_set_weak
+ */
+GEAR_API int gear_get_weak(gear_runtime *runtime, gear_register reg, gear_register dest);
+
 /*! \brief Returns the integer value stored in a register.
  *
  *  If the register stores a float, then its value is converted to an integer and returned.
@@ -377,19 +703,51 @@ GEAR_API int gear_get_bool(gear_runtime *runtime, gear_register reg);
  *
  *  If the register does not store a string, then the value will be converted to a string.
  *  If the value is an object, then its type name is returned.
+ *  Numbers are converted to the shortest string that parses back to the same value, regardless of the C locale,
+ *  unless Gear was built with #GEAR_LIBC_NUMBERS, in which case floats use a fixed precision and the C locale applies.
+ *
+ *  \note
+ *  Prior to version 0.8.0 floats were always formatted with a fixed precision, so the text returned for some floats has changed.
  *
  *  This function will not invoke the objects \b toString method.
  *  You must invoke it manually and handle any exceptions that occur.
  *
+ *  The string is encoded as UTF-8 and is always null terminated.
+ *  Strings that are stored as UTF-8, or as Latin-1 and contain only ASCII characters, are returned without being transcoded.
+ *  Strings stored with one #gear_char per character, because they were widened or Gear was built with #GEAR_NO_COMPACT_STRINGS,
+ *  are always transcoded.
+ *  Strings built by concatenation are flattened into a single buffer first.
+ *  Substrings that are views of another string's storage are not terminated, so they are copied into a terminated buffer first.
+ *  The string should be copied or used immediately because the garbage collector may move or release it.
+ *
  *  \param[in] runtime The Gear runtime.
  *  \param[in] reg The register to read from.
  *
  *  \return The value of the register as a string.
  *
  *  \since 0.1.0
+ *  \sa gear_get_string_n
  */
 GEAR_API const char *gear_get_string(gear_runtime *runtime, gear_register reg);
 
+/*! \brief Returns the string value stored in a register and its length.
+ *
+ *  Behaves like #gear_get_string except the length of the string is also returned.
+ *  The string is still null terminated, but it may contain null characters of its own, for instance, if it was set
+ *  with #gear_set_string_n, so the length should be used to find its end.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] reg The register to read from.
+ *  \param[out] length The length of the string in bytes, excluding the null terminator.
+ *
+ *  \return The value of the register as a string.
+ *
+ *  \since 0.8.0
+ *  \sa gear_get_string
+ *  \sa gear_set_string_n
+ */
+GEAR_API const char *gear_get_string_n(gear_runtime *runtime, gear_register reg, size_t *length);
+
 /*! \brief Registers a callback function to invoke on an error.
   *
   *  A breakpoint can be placed within the callback to catch the moment an error occurs.
@@ -419,4 +777,222 @@ GEAR_API void gear_set_error_callback(gear_runtime *runtime, gear_C_error callba
  */
 GEAR_API const char *gear_get_last_error(gear_runtime *runtime);
 
+/*! \brief Sets the number of threads used by the garbage collector.
+ *
+ *  The garbage collector marks the heap in parallel using a pool of worker threads.
+ *  By default, a runtime uses #GEAR_GC_WORKERS workers.
+ *  Passing zero creates one worker for each hardware thread and passing one marks the heap on a single thread.
+ *  Since each runtime owns its workers, processes hosting many runtimes should keep the count small.
+ *  If a collection is in progress, then the new worker count takes effect with the next collection.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] workers The number of worker threads.
+ *  \return A non-zero value is returned if the count is negative or the worker threads could not be created,
+ *          in which case the previous worker count is kept.
+ *
+ *  \since 0.8.0
+ */
+GEAR_API int gear_gc_set_workers(gear_runtime *runtime, int workers);
+
+/*! \brief Sets a soft limit on the length of garbage collection pauses.
+ *
+ *  The garbage collector divides its work into increments that are small enough to finish within the target pause time.
+ *  Shorter pauses mean more increments, so a collection cycle takes longer to complete and the heap may grow further before
+ *  memory is reclaimed.
+ *  The target is a soft limit: a pause can exceed it when the root set is very large.
+ *  Passing zero removes the target and the collector may finish a cycle in a single pause.
+ *
+ * \code
+ * gear_gc_set_pause_target(runtime, 1000); // Aim for pauses of at most 1 ms.
+ * gear_gc_set_cpu_target(runtime, 25);     // Use no more than 25% of the mutator's time for collection.
+ * \endcode
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] microseconds The maximum length of a pause in microseconds.
+ *  \return A non-zero value is returned if the target is negative, in which case the previous target is kept.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_set_cpu_target
+ */
+GEAR_API int gear_gc_set_pause_target(gear_runtime *runtime, int microseconds);
+
+/*! \brief Sets the share of CPU time the garbage collector may take from the program.
+ *
+ *  When a pause target is set with #gear_gc_set_pause_target, the collector spaces out its increments so that
+ *  collection work does not exceed the given percentage of the runtime's execution time.
+ *  If allocation outpaces collection, then the collector will exceed the share rather than let the heap grow without bound.
+ *  Passing zero lets the collector choose the share.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] percent The target CPU share as a percentage between 0 and 100.
+ *  \return A non-zero value is returned if the percentage is outside of this range, in which case the previous share is kept.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_set_pause_target
+ */
+GEAR_API int gear_gc_set_cpu_target(gear_runtime *runtime, int percent);
+
+/*! \brief Performs a garbage collection.
+ *
+ *  Collects garbage immediately instead of waiting for the heap to fill up.
+ *  This is useful when the host knows it is idle, for example, between frames or requests.
+ *  A minor collection only reclaims the young generation, while a full collection reclaims the entire heap.
+ *  A full collection compacts the heap if it is fragmented beyond the threshold set with #gear_gc_set_compaction.
+ *  Any collection cycle already in progress is finished first.
+ *  When Gear is built with #GEAR_NO_GENERATIONAL_GC there is no young generation, so every collection is a full collection.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] full Performs a full collection if non-zero otherwise a minor collection is performed.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_step
+ */
+GEAR_API void gear_gc_collect(gear_runtime *runtime, int full);
+
+/*! \brief Performs an increment of garbage collection work.
+ *
+ *  Advances the current collection cycle, or starts a new one, by roughly the given amount of work.
+ *  The budget is measured in bytes of heap traced or swept.
+ *  Calling this function repeatedly while the host is idle moves collection work out of latency-critical code.
+ *
+ * \code
+ * // Spend idle time between requests on collection work.
+ * while (!has_pending_request()) {
+ *     if (gear_gc_step(runtime, 64 * 1024)) {
+ *         break; // The cycle is finished.
+ *     }
+ * }
+ * \endcode
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] budget_bytes The amount of work to perform.
+ *  \return A non-zero value is returned if the collection cycle completed.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_collect
+ */
+GEAR_API int gear_gc_step(gear_runtime *runtime, size_t budget_bytes);
+
+/*! \brief Suspends garbage collection.
+ *
+ *  While garbage collection is suspended, allocation grows the heap instead of triggering a collection.
+ *  This is intended for short latency-critical sections of code.
+ *  If the heap grows beyond the given cap, then a collection is performed regardless so that the program does not run out of memory.
+ *
+ *  Calls to this function nest.
+ *  Garbage collection resumes once #gear_gc_resume has been called as many times as this function.
+ *  When calls are nested the smallest cap applies.
+ *
+ *  A cap of zero lets the heap grow up to the runtime's heap limit, or without bound if the runtime has none.
+ *  A cap above the heap limit given to #gear_new_from_file_with_allocator or #gear_new_from_memory_with_allocator
+ *  is lowered to that limit, so suspending collection never bypasses it.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] heap_cap The maximum size of the heap in bytes while collection is suspended or zero for the heap limit.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_resume
+ */
+GEAR_API void gear_gc_suspend(gear_runtime *runtime, size_t heap_cap);
+
+/*! \brief Resumes garbage collection.
+ *
+ *  Resumes garbage collection suspended with #gear_gc_suspend.
+ *  If the heap grew past the point where a collection would have been triggered, then collection work is scheduled
+ *  according to the pause target rather than performed at once.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_suspend
+ */
+GEAR_API void gear_gc_resume(gear_runtime *runtime);
+
+/*! \brief Retrieves garbage collector and heap statistics.
+ *
+ *  Statistics are updated at the end of each collection, except for the heap size and allocation counters
+ *  which are current as of the call.
+ *
+ * \code
+ * gear_gc_stats stats;
+ * stats.size = sizeof(stats);
+ * gear_gc_get_stats(runtime, &stats);
+ * \endcode
+ *
+ *  The runtime never writes beyond \c size bytes and lowers \c size if it fills in fewer fields than the host expects.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in,out] out The structure in which the statistics are stored. Its \c size field must be set by the caller.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_set_callback
+ */
+GEAR_API void gear_gc_get_stats(gear_runtime *runtime, gear_gc_stats *out);
+
+/*! \brief Registers a callback function to invoke at the end of each garbage collection.
+ *
+ *  The callback receives the statistics of the collection that just finished.
+ *  This can be used to log, tune, or alert on memory behavior without external tools.
+ *  Passing NULL removes the callback from the runtime.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] callback A function to invoke when a collection ends.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_get_stats
+ */
+GEAR_API void gear_gc_set_callback(gear_runtime *runtime, gear_C_gc callback);
+
+/*! \brief Sets the fragmentation threshold that triggers heap compaction.
+ *
+ *  Long-running programs can fragment the heap until it is several times larger than the memory that is actually live.
+ *  When fragmentation exceeds the threshold, full collections compact the heap to return memory.
+ *  By default, a runtime uses a threshold of #GEAR_GC_COMPACT_THRESHOLD.
+ *  Passing zero disables compaction.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] percent The percentage of free space in partially used pages that triggers compaction.
+ *  \return A non-zero value is returned if the percentage is outside of the range 0 to 100, in which case the previous threshold is kept.
+ *
+ *  \since 0.8.0
+ *  \sa gear_gc_collect
+ */
+GEAR_API int gear_gc_set_compaction(gear_runtime *runtime, int percent);
+
+/*! \brief Begins an allocation region.
+ *
+ *  Until the region ends, objects are allocated in an arena that is released as a whole by #gear_region_end
+ *  rather than traced and swept by the garbage collector.
+ *  This applies to allocations made by the host and by Gear code called while the region is active.
+ *  Regions are intended for object graphs with a well-defined lifetime, such as the objects created while handling a request.
+ *
+ * \code
+ * gear_region_begin(runtime, GEAR_REGION_PROMOTE);
+ * gear_call_by_name(runtime, "handleRequest", 1);
+ * gear_region_end(runtime); // Everything allocated by the request is released here.
+ * \endcode
+ *
+ *  Regions can be nested and must be ended in the reverse order they were begun.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \param[in] policy How references that escape the region are handled.
+ *
+ *  \since 0.8.0
+ *  \sa gear_region_end
+ */
+GEAR_API void gear_region_begin(gear_runtime *runtime, gear_region_policy policy);
+
+/*! \brief Ends the innermost allocation region.
+ *
+ *  Escaping references are handled according to the policy the region was begun with
+ *  and then all memory allocated in the region is released.
+ *
+ *  \param[in] runtime The Gear runtime.
+ *  \return A non-zero value is returned if the region used #GEAR_REGION_ERROR and escaping references were found.
+ *
+ *  \since 0.8.0
+ *  \sa gear_region_begin
+ */
+GEAR_API int gear_region_end(gear_runtime *runtime);
+
 #endif